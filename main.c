@@ -4,6 +4,9 @@
 #include "vector.h"
 #include "color.h"
 #include "spheres.h"
+#ifdef PROGRESSIVE
+#include <time.h>
+#endif
 
 Vec3 cameraPosition = {0, 0, 0};
 
@@ -192,11 +195,133 @@ Vec3 calculatePixelColorFS(Intersection hit, World *world, Vec3 lightPos, float
     return surfaceLightingColor;
 }
 
+// Traces one sample of the 3x3 grid (sampleX, sampleY) through pixel (x, y)
+Vec3 traceSampleFS(int x, int y, int imageWidth, int imageHeight, int sampleX, int sampleY, World *world, float lightBrightness) {
+    Ray ray = generateRayFS(x, y, imageWidth, imageHeight, sampleX, sampleY);
+
+    // Find closest intersection
+    Intersection hit = {0};
+    float closestDistance = INFINITY;
+    for (int i = 0; i < world->size; i++) {
+        float t;
+        if (doesIntersect(world->spheres[i], ray.origin, ray.direction, &t) && t > 0.01f) {
+            if (t < closestDistance) {
+                closestDistance = t;
+                hit.hit = 1;
+                hit.point = add(ray.origin, scalarMultiply(t, ray.direction));
+                hit.sphere = world->spheres[i];
+            }
+        }
+    }
+
+    // Calculate pixel color for this sample
+    return calculatePixelColorFS(hit, world, light.position, lightBrightness);
+}
+
+// Averages the 3x3 sample grid of pixel (x, y).
+// If centerSample is not NULL it is used instead of tracing the middle sample again.
+Vec3 supersamplePixelFS(int x, int y, int imageWidth, int imageHeight, World *world, float lightBrightness, const Vec3 *centerSample) {
+    // Variables to accumulate the color
+    Vec3 pixelColor = {0, 0, 0};
+
+    // Sample the pixel 9 times (3x3 grid)
+    for (int sampleY = 0; sampleY < 3; sampleY++) {
+        for (int sampleX = 0; sampleX < 3; sampleX++) {
+            Vec3 sampleColor;
+            if (centerSample != NULL && sampleX == 1 && sampleY == 1) {
+                sampleColor = *centerSample;
+            } else {
+                sampleColor = traceSampleFS(x, y, imageWidth, imageHeight, sampleX, sampleY, world, lightBrightness);
+            }
+            pixelColor = add(pixelColor, sampleColor);
+        }
+    }
+
+    // Average the pixel color from all 9 samples
+    return scalarMultiply(1.0f / 9.0f, pixelColor);
+}
+
+#ifdef PROGRESSIVE
+// Size of the blocks in the first (coarsest) preview pass
+#define PROGRESSIVE_START_BLOCK 8
+
+// One coarse-to-fine preview pass: traces the center sample of every blockSize x blockSize
+// block that the previous (twice as coarse) pass did not already trace, and fills the block with it.
+// After the blockSize == 1 pass every pixel holds its own center sample.
+void renderBlockPassFS(Vec3 *pixels, int blockSize, int imageWidth, int imageHeight, World *world, float lightBrightness) {
+    int coarserSize = blockSize * 2;
+    for (int y = 0; y < imageHeight; y += blockSize) {
+        for (int x = 0; x < imageWidth; x += blockSize) {
+            // Already traced by the previous pass
+            if (blockSize < PROGRESSIVE_START_BLOCK && x % coarserSize == 0 && y % coarserSize == 0) {
+                continue;
+            }
+
+            Vec3 sampleColor = traceSampleFS(x, y, imageWidth, imageHeight, 1, 1, world, lightBrightness);
+            for (int blockY = y; blockY < y + blockSize && blockY < imageHeight; blockY++) {
+                for (int blockX = x; blockX < x + blockSize && blockX < imageWidth; blockX++) {
+                    pixels[blockY * imageWidth + blockX] = sampleColor;
+                }
+            }
+        }
+    }
+}
+
+void writeImage(FILE *ppmFile, const Vec3 *pixels, int imageWidth, int imageHeight) {
+    // PPM header
+    fprintf(ppmFile, "P3\n%d %d\n255\n", imageWidth, imageHeight);
+
+    for (int y = 0; y < imageHeight; y++) {
+        for (int x = 0; x < imageWidth; x++) {
+            writeColour(ppmFile, pixels[y * imageWidth + x]);
+        }
+        fprintf(ppmFile, "\n");
+    }
+}
+
+// Emits the current image after a pass. "-" streams the snapshots to stdout (for a pipe),
+// any other target is used as a prefix: <target>_pass<N>.ppm. NULL disables snapshots.
+void writeSnapshot(const char *target, int pass, const Vec3 *pixels, int imageWidth, int imageHeight) {
+    if (target == NULL) {
+        return;
+    }
+
+    if (target[0] == '-' && target[1] == '\0') {
+        writeImage(stdout, pixels, imageWidth, imageHeight);
+        fflush(stdout);
+        return;
+    }
+
+    char snapshotPath[4096];
+    snprintf(snapshotPath, sizeof(snapshotPath), "%s_pass%d.ppm", target, pass);
+    FILE *snapshotFile = fopen(snapshotPath, "w");
+    if (snapshotFile == NULL) {
+        fprintf(stderr, "Error opening snapshot file %s.\n", snapshotPath);
+        return;
+    }
+    writeImage(snapshotFile, pixels, imageWidth, imageHeight);
+    fclose(snapshotFile);
+}
+
+double elapsedMilliseconds(struct timespec start) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (now.tv_sec - start.tv_sec) * 1000.0 + (now.tv_nsec - start.tv_nsec) / 1000000.0;
+}
+#endif
+
 int main(int argc, char *argv[]) {
+    #ifdef PROGRESSIVE
+    if (argc != 3 && argc != 4) {
+        fprintf(stderr, "Usage: %s <input_file> <output_file> [snapshot_prefix | -]\n", argv[0]);
+        return 1;
+    }
+    #else
     if (argc != 3) {
         fprintf(stderr, "Usage: %s <input_file> <output_file>\n", argv[0]);
         return 1;
     }
+    #endif
 
     FILE *inputFile = fopen(argv[1], "r");
     if (inputFile == NULL) {
@@ -373,6 +498,52 @@ int main(int argc, char *argv[]) {
 
 
     #ifdef FS
+    #ifdef PROGRESSIVE
+    // Progressive preview: one sample per 8x8 block, then 4x4, 2x2 and per pixel,
+    // then the full 3x3 supersampling. Every pass reuses the samples traced before it.
+    const char *snapshotTarget = (argc == 4) ? argv[3] : NULL;
+    Vec3 *pixels = malloc(sizeof(Vec3) * imageWidth * imageHeight);
+    if (pixels == NULL) {
+        fprintf(stderr, "Memory allocation failed!\n");
+        exit(1);
+    }
+
+    struct timespec renderStart;
+    timespec_get(&renderStart, TIME_UTC);
+    double timeToFirstImage = 0.0;
+    int pass = 0;
+
+    for (int blockSize = PROGRESSIVE_START_BLOCK; blockSize >= 1; blockSize /= 2) {
+        renderBlockPassFS(pixels, blockSize, imageWidth, imageHeight, &world, lightBrightness);
+        writeSnapshot(snapshotTarget, ++pass, pixels, imageWidth, imageHeight);
+        if (pass == 1) {
+            timeToFirstImage = elapsedMilliseconds(renderStart);
+        }
+    }
+
+    // Final pass: complete the 3x3 grid of every pixel around its existing center sample
+    for (int y = 0; y < imageHeight; y++) {
+        for (int x = 0; x < imageWidth; x++) {
+            Vec3 *pixel = &pixels[y * imageWidth + x];
+            *pixel = supersamplePixelFS(x, y, imageWidth, imageHeight, &world, lightBrightness, pixel);
+        }
+    }
+    writeSnapshot(snapshotTarget, ++pass, pixels, imageWidth, imageHeight);
+
+    FILE *outputFile = fopen(argv[2], "w");
+    if (outputFile == NULL) {
+        fprintf(stderr, "Error opening output file.\n");
+        return 1;
+    }
+    writeImage(outputFile, pixels, imageWidth, imageHeight);
+    fclose(outputFile);
+
+    double timeToFinal = elapsedMilliseconds(renderStart);
+    fprintf(stderr, "Time to first image: %.3f ms\n", timeToFirstImage);
+    fprintf(stderr, "Time to final image: %.3f ms\n", timeToFinal);
+
+    free(pixels);
+    #else
     FILE *outputFile = fopen(argv[2], "w");
     if (outputFile == NULL) {
         fprintf(stderr, "Error opening output file.\n");
@@ -383,48 +554,17 @@ int main(int argc, char *argv[]) {
     fprintf(outputFile, "P3\n%d %d\n255\n", imageWidth, imageHeight);
 
     for (int y = 0; y < imageHeight; y++) {
-    for (int x = 0; x < imageWidth; x++) {
-        // Variables to accumulate the color
-        Vec3 pixelColor = {0, 0, 0};
-
-        // Sample the pixel 9 times (3x3 grid)
-        for (int sampleY = 0; sampleY < 3; sampleY++) {
-            for (int sampleX = 0; sampleX < 3; sampleX++) {
-                Ray ray = generateRayFS(x, y, imageWidth, imageHeight, sampleX, sampleY);
-
-                // Find closest intersection
-                Intersection hit = {0};
-                float closestDistance = INFINITY;
-                for (int i = 0; i < world.size; i++) {
-                    float t;
-                    if (doesIntersect(world.spheres[i], ray.origin, ray.direction, &t) && t > 0.01f) {
-                        if (t < closestDistance) {
-                            closestDistance = t;
-                            hit.hit = 1;
-                            hit.point = add(ray.origin, scalarMultiply(t, ray.direction));
-                            hit.sphere = world.spheres[i];
-                        }
-                    }
-                }
-                // Assuming colors is an array of unsigned int representing color values
+        for (int x = 0; x < imageWidth; x++) {
+            Vec3 pixelColor = supersamplePixelFS(x, y, imageWidth, imageHeight, &world, lightBrightness, NULL);
 
-                // Calculate pixel color for this sample
-                Vec3 sampleColor = calculatePixelColorFS(hit, &world, light.position, lightBrightness);
-                pixelColor = add(pixelColor, sampleColor);
-            }
+            // Output the averaged pixel color
+            writeColour(outputFile, pixelColor);
         }
-
-        // Average the pixel color from all 9 samples
-        pixelColor = scalarMultiply(1.0f / 9.0f, pixelColor);
-
-        // Output the averaged pixel color
-        writeColour(outputFile, pixelColor);
-    }
-    fprintf(outputFile, "\n");
+        fprintf(outputFile, "\n");
     }
 
     fclose(outputFile);
-    
+    #endif
     #endif
 
 